@@ -0,0 +1,45 @@
+//
+//  XCTOptimizationBarriers.h
+//
+//  Compiler barriers for performance tests. This header is not part of
+//  XCTest.framework; add this directory to the header search paths and
+//  import it explicitly.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ * @define XCTDoNotOptimize(value)
+ * Forces value to be computed and treated as used. Use it to keep the compiler from discarding the result of
+ * code measured with -measureBlock:.
+ *
+ * Only value itself is affected: it is not a memory barrier, so other loads and stores in the measured loop may
+ * still be combined or moved. value is passed to the barrier directly, not copied, so an lvalue such as a large
+ * struct variable is referenced in place. value must not have type void.
+ * @textblock
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000000; i++) {
+            XCTDoNotOptimize([string hash]);
+        }
+    }];
+
+ * @/textblock
+ */
+#define XCTDoNotOptimize(value) \
+    __asm__ __volatile__("" : : "r,m"(value))
+
+/*!
+ * @function XCTClobberMemory
+ * Forces all pending memory writes to be performed and all memory to be reloaded afterwards. Use it to keep
+ * the compiler from eliding or hoisting stores out of a measured loop, including those made by a call whose
+ * result is void. Unlike XCTDoNotOptimize(), this constrains every memory access around it.
+ */
+NS_INLINE void XCTClobberMemory(void)
+{
+    __asm__ __volatile__("" : : : "memory");
+}
+
+NS_ASSUME_NONNULL_END